@@ -0,0 +1,75 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+
+#include "Command.h"
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+void CommandReset(CommandParser_t *parser)
+{
+  parser->state = COMMAND_STATE_IDLE;
+  parser->servo = 0;
+  parser->value = 0;
+  parser->numDigits = 0;
+}
+
+//----------------------------------------------------------------------------
+// Feed one received byte to the "s<servo><dddd>" parser. Returns 1 and fills
+// in servo/value when a complete command has been received; any unexpected
+// byte is consumed and the parser goes back to waiting for 's'.
+//----------------------------------------------------------------------------
+int CommandParseByte(CommandParser_t *parser, uint8_t ch, int *servo, int *value)
+{
+  int complete = 0;
+
+  switch (parser->state)
+  {
+    case COMMAND_STATE_IDLE:
+      if (ch == 's')
+      {
+        parser->state = COMMAND_STATE_SERVO;
+      }
+      break;
+
+    case COMMAND_STATE_SERVO:
+      if ((ch >= '0') && (ch < ('0' + COMMAND_NUM_SERVOS)))
+      {
+        parser->servo = ch - '0';
+        parser->value = 0;
+        parser->numDigits = 0;
+        parser->state = COMMAND_STATE_VALUE;
+      }
+      else
+      {
+        CommandReset(parser);
+      }
+      break;
+
+    case COMMAND_STATE_VALUE:
+      if ((ch >= '0') && (ch <= '9'))
+      {
+        parser->value = (parser->value * 10) + (ch - '0');
+
+        if (++parser->numDigits == COMMAND_NUM_DIGITS)
+        {
+          *servo = parser->servo;
+          *value = parser->value;
+          complete = 1;
+          CommandReset(parser);
+        }
+      }
+      else
+      {
+        CommandReset(parser);
+      }
+      break;
+
+    default:
+      CommandReset(parser);
+      break;
+  }
+
+  return complete;
+}
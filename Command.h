@@ -0,0 +1,32 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+
+#ifndef _COMMAND_H_
+#define _COMMAND_H_
+
+#include <stdint.h>
+
+#define COMMAND_NUM_SERVOS      (4)
+#define COMMAND_NUM_DIGITS      (4)
+
+typedef enum
+{
+  COMMAND_STATE_IDLE,     // waiting for 's'
+  COMMAND_STATE_SERVO,    // waiting for servo number '0'..'3'
+  COMMAND_STATE_VALUE     // collecting pulse width digits
+} CommandState_t;
+
+typedef struct
+{
+  CommandState_t state;
+  int servo;
+  int value;
+  int numDigits;
+} CommandParser_t;
+
+// No hardware dependencies; also built on the host by host/Makefile.
+void CommandReset(CommandParser_t *parser);
+int CommandParseByte(CommandParser_t *parser, uint8_t ch, int *servo, int *value);
+
+#endif
@@ -12,6 +12,10 @@
 #include "stm32f10x_gpio.h" 
 #include "stm32f10x_tim.h" 
 #include "USART.h"
+#include "Command.h"
+
+static CommandParser_t cmdParser;
+static uint32_t lastRxMsec;
 
 void InitializeTimer(int period)
 {
@@ -65,6 +69,38 @@ void InitializePWMChannel()
 //----------------------------------------------------------------------------
 void AppInit(void)
 {
+  CommandReset(&cmdParser);
+  lastRxMsec = BoardGetSysTicks();
+}
+
+//----------------------------------------------------------------------------
+// Handle at most one received byte; a partial command is dropped if the
+// sender paused for more than 10msec.
+//----------------------------------------------------------------------------
+void AppPoll(void)
+{
+  int servo, value;
+  
+  if (USARTRxAvailable(USART_DEVNUM_1))
+  {      
+    if (BoardHasExpiredMsec(&lastRxMsec, 10))
+    {
+      CommandReset(&cmdParser);
+    }
+    lastRxMsec = BoardGetSysTicks();
+    
+    if (CommandParseByte(&cmdParser, USARTReadByte(USART_DEVNUM_1), &servo, &value))
+    {
+      switch (servo)
+      {
+        case 0: TIM_SetCompare1(TIM4, value); break;
+        case 1: TIM_SetCompare2(TIM4, value); break;
+        case 2: TIM_SetCompare3(TIM4, value); break;
+        case 3: TIM_SetCompare4(TIM4, value); break;
+        default: break;
+      }
+    }
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -72,8 +108,6 @@ void AppInit(void)
 //----------------------------------------------------------------------------
 void AppMain(void)
 { 
-  uint8_t ch;
-  
   InitializeTimer(20000);
   InitializePWMChannel();
   
@@ -86,58 +120,7 @@ void AppMain(void)
 
   while (1)
   {        
-    if (USARTRxAvailable(USART_DEVNUM_1))
-    {      
-      if (!USARTReadWait(USART_DEVNUM_1, &ch))
-      {
-        if (ch == 's')
-        {
-          if (!USARTReadWait(USART_DEVNUM_1, &ch))
-          {
-            switch (ch)
-            {
-              case '0':
-              case '1':
-              case '2':
-              case '3':
-              {
-                int servo = ch - '0';
-                if (!USARTReadWait(USART_DEVNUM_1, &ch))
-                {
-                  int value, d3, d2, d1, d0;
-                  
-                  d3 = ch - '0';
-                  if ((d3 >= 0) && (d3 <= 9) && !USARTReadWait(USART_DEVNUM_1, &ch))
-                  {
-                    d2 = ch - '0';
-                    if ((d2 >= 0) && (d2 <= 9) && !USARTReadWait(USART_DEVNUM_1, &ch))
-                    {
-                      d1 = ch - '0';
-                      if ((d1 >= 0) && (d1 <= 9) && !USARTReadWait(USART_DEVNUM_1, &ch))
-                      {
-                        d0 = ch - '0';
-                        if ((d0 >= 0) && (d0 <= 9))
-                        {
-                          value = (d3 * 1000) + (d2 * 100) + (d1 * 10) + d0;
-                          switch (servo)
-                          {
-                            case 0: TIM_SetCompare1(TIM4, value); break;
-                            case 1: TIM_SetCompare2(TIM4, value); break;
-                            case 2: TIM_SetCompare3(TIM4, value); break;
-                            case 3: TIM_SetCompare4(TIM4, value); break;
-                          }
-                        }
-                      }
-                    }
-                  }
-                }
-              }
-              break;
-            }
-          }
-        }
-      }
-    }
+    AppPoll();
   }
 }
 
@@ -23,7 +23,8 @@ typedef struct
   uint8_t                     txBuffer[USART_BUFFER_SIZE];
   uint32_t                    txBufferTail;
   uint32_t                    txBufferHead;
-  uint32_t                    txBufferCount;
+  uint32_t                    txBufferCount;   // bytes queued, including the transfer in flight
+  uint32_t                    txDMACount;      // bytes in the transfer in flight
   DMA_Channel_TypeDef        *dmaTxChannel;
   DMA_Channel_TypeDef        *dmaRxChannel;
   IRQn_Type                   dmaTxIRQChannel;
@@ -44,17 +45,18 @@ static void USARTSetupTxDMA(USARTDevNum_t devNum)
   
   if (devPtr->txBufferHead > devPtr->txBufferTail)
   {
-    devPtr->dmaTxChannel->CNDTR = devPtr->txBufferHead - devPtr->txBufferTail;
-    devPtr->txBufferCount = devPtr->txBufferHead - devPtr->txBufferTail;
+    devPtr->txDMACount = devPtr->txBufferHead - devPtr->txBufferTail;
     devPtr->txBufferTail = devPtr->txBufferHead;
   }
   else
   {
-    devPtr->dmaTxChannel->CNDTR = USART_BUFFER_SIZE - devPtr->txBufferTail;
-    devPtr->txBufferCount = USART_BUFFER_SIZE - devPtr->txBufferTail;
+    // send up to the end of the buffer, the rest goes in the next transfer
+    devPtr->txDMACount = USART_BUFFER_SIZE - devPtr->txBufferTail;
     devPtr->txBufferTail = 0;
   }
 
+  devPtr->dmaTxChannel->CNDTR = devPtr->txDMACount;
+
   if (devPtr->txBufferCount > devPtr->stats.maxTxFifoCount)
     { devPtr->stats.maxTxFifoCount = devPtr->txBufferCount; }
 
@@ -102,6 +104,7 @@ void USARTFlush(USARTDevNum_t devNum)
   devPtr->txBufferHead = 0;
   devPtr->txBufferTail = 0;
   devPtr->txBufferCount = 0;
+  devPtr->txDMACount = 0;
   devPtr->rxDMAIdx = DMA_GetCurrDataCounter(devPtr->dmaRxChannel);
   NVIC_EnableIRQ(devPtr->dmaTxIRQChannel);
 }
@@ -152,7 +155,17 @@ void USARTWriteByte(USARTDevNum_t devNum, uint8_t ch, int lastByte)
 {
   USARTDevStruct_t *devPtr = &device[devNum];
   
-  while (devPtr->txBufferCount == USART_BUFFER_SIZE) { __WFI(); };
+  while (devPtr->txBufferCount == USART_BUFFER_SIZE)
+  {
+    // a full buffer with no transfer running would never drain
+    if ((devPtr->dmaTxChannel->CCR & DMA_CCR1_EN) == 0)
+    {
+      NVIC_DisableIRQ(devPtr->dmaTxIRQChannel);
+      USARTSetupTxDMA(devNum);
+      NVIC_EnableIRQ(devPtr->dmaTxIRQChannel);
+    }
+    __WFI();
+  }
   
   NVIC_DisableIRQ(devPtr->dmaTxIRQChannel);
   devPtr->txBuffer[devPtr->txBufferHead] = ch;
@@ -235,6 +248,8 @@ void DMA1_Channel4_IRQHandler(void)
   
   DMA_ClearITPendingBit(DMA1_IT_TC4);
   DMA_Cmd(devPtr->dmaTxChannel, DISABLE);
+  devPtr->txBufferCount -= devPtr->txDMACount;
+  devPtr->txDMACount = 0;
 
   if (devPtr->txBufferHead != devPtr->txBufferTail)
   {
@@ -0,0 +1,108 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Runs the AppMain receive step (AppPoll) against the host USART and checks
+//  which servo compare registers each input moves, including the 10msec
+//  inter-byte timeout.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f10x.h"
+#include "USART.h"
+#include "Host.h"
+
+void AppInit(void);
+void AppPoll(void);
+void SysTick_Handler(void);
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void Reset(void)
+{
+  USARTHostInit();
+  AppInit();
+  memset(&hostTIM4, 0, sizeof(hostTIM4));
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void Receive(const char *str)
+{
+  USARTHostRxInject((const uint8_t *)str, (uint32_t)strlen(str));
+
+  while (USARTRxAvailable(USART_DEVNUM_1))
+  {
+    AppPoll();
+  }
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void Wait(uint32_t msec)
+{
+  while (msec--)
+  {
+    SysTick_Handler();
+  }
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void Expect(const char *str, int c0, int c1, int c2, int c3)
+{
+  Reset();
+  Receive(str);
+
+  if ((hostTIM4.CCR[0] != c0) || (hostTIM4.CCR[1] != c1) ||
+      (hostTIM4.CCR[2] != c2) || (hostTIM4.CCR[3] != c3))
+  {
+    fprintf(stderr, "\"%s\": got %u %u %u %u, expected %d %d %d %d\n", str,
+            hostTIM4.CCR[0], hostTIM4.CCR[1], hostTIM4.CCR[2], hostTIM4.CCR[3],
+            c0, c1, c2, c3);
+    HostFail(__FILE__, __LINE__, "servo compare values");
+  }
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+int main(void)
+{
+  Expect("s01500", 1500, 0, 0, 0);
+  Expect("ss01500", 0, 0, 0, 0);
+  Expect("s41500", 0, 0, 0, 0);
+  Expect("s0150x", 0, 0, 0, 0);
+  Expect("s10000", 0, 0, 0, 0);
+  Expect("xs21234s10000", 0, 0, 1234, 0);
+  Expect("s01000s12000s23000s39999", 1000, 2000, 3000, 9999);
+  Expect("s0150s01500", 0, 0, 0, 0);
+
+  // a 9msec pause mid-command is tolerated
+  Reset();
+  Receive("s0");
+  Wait(9);
+  Receive("1500");
+  HOST_CHECK(hostTIM4.CCR[0] == 1500);
+
+  // 10msec drops the partial command; the rest is parsed from scratch
+  Reset();
+  Receive("s0");
+  Wait(10);
+  Receive("1500s31234");
+  HOST_CHECK(hostTIM4.CCR[0] == 0);
+  HOST_CHECK(hostTIM4.CCR[3] == 1234);
+
+  // an idle line before a command doesn't count against it
+  Reset();
+  Wait(1000);
+  Receive("s22000");
+  HOST_CHECK(hostTIM4.CCR[2] == 2000);
+
+  printf("AppTest: OK\n");
+  return 0;
+}
@@ -0,0 +1,195 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Host throughput numbers for the receive/transmit path:
+//    - CommandParseByte over ASCII command streams (valid, noisy, all 's')
+//    - USARTReadByte draining the RX ring across the wrap
+//    - USARTWriteBuf enqueue rate with the TX ring wrapping continuously
+//  The servo protocol is ASCII only; there is no binary format to measure.
+//  Cycle counts come from the host time stamp counter and are only a guide
+//  to relative cost on the target.
+//
+//  Usage: CommandBench [megabytes]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Command.h"
+#include "USART.h"
+#include "Host.h"
+
+#define BENCH_STREAM_SIZE     (1024 * 1024)
+#define BENCH_RX_CHUNK        (1000)
+
+static uint8_t stream[BENCH_STREAM_SIZE];
+static volatile uint32_t benchSink;
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void Report(const char *name, uint64_t numBytes, uint64_t numCmds, uint64_t nsec, uint64_t cycles)
+{
+  double seconds = (double)nsec / 1e9;
+
+  printf("  %-24s %8.1f MB/s  %6.2f cycles/byte", name,
+         ((double)numBytes / seconds) / 1e6, (double)cycles / (double)numBytes);
+
+  if (numCmds)
+  {
+    printf("  %6.1f cycles/cmd  %5.1f ns/cmd",
+           (double)cycles / (double)numCmds, (double)nsec / (double)numCmds);
+  }
+
+  printf("\n");
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void BenchParser(const char *name, uint32_t passes)
+{
+  CommandParser_t parser;
+  uint64_t numCmds = 0, startNsec, startCycles, nsec, cycles;
+  uint32_t pass, i, sum = 0;
+  int servo, value;
+
+  CommandReset(&parser);
+
+  startNsec = HostNsec();
+  startCycles = HostCycles();
+
+  for (pass = 0; pass < passes; pass++)
+  {
+    for (i = 0; i < BENCH_STREAM_SIZE; i++)
+    {
+      if (CommandParseByte(&parser, stream[i], &servo, &value))
+      {
+        sum += (uint32_t)(servo + value);
+        numCmds++;
+      }
+    }
+  }
+
+  cycles = HostCycles() - startCycles;
+  nsec = HostNsec() - startNsec;
+  benchSink = sum;
+
+  Report(name, (uint64_t)passes * BENCH_STREAM_SIZE, numCmds, nsec, cycles);
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void BenchParsers(uint32_t passes)
+{
+  uint32_t i;
+
+  for (i = 0; i + 6 <= BENCH_STREAM_SIZE; i += 6)
+  {
+    sprintf((char *)&stream[i], "s%u%04u", (unsigned)(HostRandom() % COMMAND_NUM_SERVOS),
+            (unsigned)(HostRandom() % 10000));
+  }
+  for (; i < BENCH_STREAM_SIZE; i++) { stream[i] = '\n'; }
+  BenchParser("parse valid commands", passes);
+
+  for (i = 0; i < BENCH_STREAM_SIZE; i++)
+  {
+    uint32_t r = HostRandom();
+
+    stream[i] = ((r & 3) == 0) ? 's' : ((r & 3) == 1) ? (uint8_t)(r >> 8) : (uint8_t)('0' + ((r >> 8) % 10));
+  }
+  BenchParser("parse noisy stream", passes);
+
+  for (i = 0; i < BENCH_STREAM_SIZE; i++) { stream[i] = 's'; }
+  BenchParser("parse repeated 's'", passes);
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void BenchRx(uint32_t passes)
+{
+  uint64_t numBytes = 0, nsec = 0, cycles = 0;
+  uint32_t pass, offset, i, sum = 0;
+
+  USARTHostInit();
+
+  for (pass = 0; pass < passes; pass++)
+  {
+    for (offset = 0; offset + BENCH_RX_CHUNK <= BENCH_STREAM_SIZE; offset += BENCH_RX_CHUNK)
+    {
+      uint64_t startNsec, startCycles;
+
+      USARTHostRxInject(&stream[offset], BENCH_RX_CHUNK);
+
+      startNsec = HostNsec();
+      startCycles = HostCycles();
+
+      for (i = 0; i < BENCH_RX_CHUNK; i++)
+      {
+        sum += USARTReadByte(USART_DEVNUM_1);
+      }
+
+      cycles += HostCycles() - startCycles;
+      nsec += HostNsec() - startNsec;
+      numBytes += BENCH_RX_CHUNK;
+    }
+  }
+
+  HOST_CHECK(!USARTRxAvailable(USART_DEVNUM_1));
+  benchSink = sum;
+
+  Report("RX ring read", numBytes, 0, nsec, cycles);
+}
+
+//----------------------------------------------------------------------------
+// DMA transfers only complete when the writer blocks in __WFI(), so the
+// ring runs full and wraps on almost every message.
+//----------------------------------------------------------------------------
+static void BenchTx(const char *name, uint16_t msgSize, uint32_t passes)
+{
+  uint64_t numBytes = 0, startNsec, startCycles, nsec, cycles;
+  uint32_t pass, offset;
+
+  USARTHostInit();
+  USARTHostTxSink(0, 0);
+
+  startNsec = HostNsec();
+  startCycles = HostCycles();
+
+  for (pass = 0; pass < passes; pass++)
+  {
+    for (offset = 0; offset + msgSize <= BENCH_STREAM_SIZE; offset += msgSize)
+    {
+      USARTWriteBuf(USART_DEVNUM_1, &stream[offset], msgSize);
+      numBytes += msgSize;
+    }
+  }
+
+  cycles = HostCycles() - startCycles;
+  nsec = HostNsec() - startNsec;
+
+  USARTHostTxDrain();
+  HOST_CHECK(USARTHostTxSent() == numBytes);
+
+  Report(name, numBytes, 0, nsec, cycles);
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  uint32_t passes = (argc > 1) ? (uint32_t)strtoul(argv[1], 0, 0) : 16;
+
+  if (passes == 0) { passes = 1; }
+
+  printf("CommandBench: %u MB per case\n", passes);
+  BenchParsers(passes);
+  BenchRx(passes);
+  BenchTx("TX enqueue 6 byte msgs", 6, passes);
+  BenchTx("TX enqueue 100 byte msgs", 100, passes);
+  BenchTx("TX enqueue 1000 byte msgs", 1000, passes);
+
+  return 0;
+}
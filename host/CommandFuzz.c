@@ -0,0 +1,247 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Feeds random and adversarial byte streams through CommandParseByte and
+//  checks every command it reports against a model of the original blocking
+//  parser in AppMain (each byte read is consumed, a bad byte abandons the
+//  command). Also checks that the parser state stays within CommandState_t
+//  and always finds its way back to idle.
+//
+//  Usage: CommandFuzz [iterations] [seed]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Command.h"
+#include "Host.h"
+
+#define FUZZ_MAX_STREAM       (256)
+#define FUZZ_MAX_COMMANDS     (FUZZ_MAX_STREAM / 2)
+
+typedef struct
+{
+  int servo;
+  int value;
+} FuzzCommand_t;
+
+static uint32_t numStreams;
+static uint32_t numBytes;
+static uint32_t numCommands;
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static int IsDigit(uint8_t ch)
+{
+  return (ch >= '0') && (ch <= '9');
+}
+
+//----------------------------------------------------------------------------
+// Model of the nested USARTReadWait parser, with no inter-byte timeouts
+//----------------------------------------------------------------------------
+static int ReferenceParse(const uint8_t *buf, int size, FuzzCommand_t *cmds)
+{
+  int i = 0, numCmds = 0;
+
+  while (i < size)
+  {
+    int servo, value = 0, d;
+
+    if (buf[i++] != 's') { continue; }
+    if (i >= size) { break; }
+
+    servo = buf[i++] - '0';
+    if ((servo < 0) || (servo >= COMMAND_NUM_SERVOS)) { continue; }
+
+    for (d = 0; (d < COMMAND_NUM_DIGITS) && (i < size); d++)
+    {
+      uint8_t ch = buf[i++];
+
+      if (!IsDigit(ch)) { break; }
+      value = (value * 10) + (ch - '0');
+    }
+
+    if (d == COMMAND_NUM_DIGITS)
+    {
+      cmds[numCmds].servo = servo;
+      cmds[numCmds].value = value;
+      numCmds++;
+    }
+  }
+
+  return numCmds;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void CheckParserState(const CommandParser_t *parser, int nonIdleRun)
+{
+  int limit = 1, i;
+
+  HOST_CHECK((parser->state == COMMAND_STATE_IDLE) ||
+             (parser->state == COMMAND_STATE_SERVO) ||
+             (parser->state == COMMAND_STATE_VALUE));
+
+  // 's', the servo number and all but the last digit
+  HOST_CHECK(nonIdleRun <= 1 + COMMAND_NUM_DIGITS);
+
+  if (parser->state == COMMAND_STATE_VALUE)
+  {
+    HOST_CHECK((parser->servo >= 0) && (parser->servo < COMMAND_NUM_SERVOS));
+    HOST_CHECK((parser->numDigits >= 0) && (parser->numDigits < COMMAND_NUM_DIGITS));
+
+    for (i = 0; i < parser->numDigits; i++) { limit *= 10; }
+    HOST_CHECK((parser->value >= 0) && (parser->value < limit));
+  }
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void FuzzStream(const uint8_t *buf, int size)
+{
+  static FuzzCommand_t expected[FUZZ_MAX_COMMANDS];
+  CommandParser_t parser;
+  int numExpected, numFound = 0, nonIdleRun = 0, i;
+
+  HOST_CHECK(size <= FUZZ_MAX_STREAM);
+  numExpected = ReferenceParse(buf, size, expected);
+
+  CommandReset(&parser);
+
+  for (i = 0; i < size; i++)
+  {
+    int servo = -1, value = -1;
+
+    if (CommandParseByte(&parser, buf[i], &servo, &value))
+    {
+      HOST_CHECK(parser.state == COMMAND_STATE_IDLE);
+      HOST_CHECK((servo >= 0) && (servo < COMMAND_NUM_SERVOS));
+      HOST_CHECK((value >= 0) && (value <= 9999));
+      HOST_CHECK(numFound < numExpected);
+      HOST_CHECK(servo == expected[numFound].servo);
+      HOST_CHECK(value == expected[numFound].value);
+      numFound++;
+    }
+
+    nonIdleRun = (parser.state == COMMAND_STATE_IDLE) ? 0 : nonIdleRun + 1;
+    CheckParserState(&parser, nonIdleRun);
+  }
+
+  HOST_CHECK(numFound == numExpected);
+
+  // whatever was left half parsed, one byte that can't continue a command
+  // must put the parser back to idle
+  {
+    int servo, value;
+
+    HOST_CHECK(!CommandParseByte(&parser, 'x', &servo, &value));
+    HOST_CHECK(parser.state == COMMAND_STATE_IDLE);
+  }
+
+  numStreams++;
+  numBytes += size;
+  numCommands += numFound;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void FuzzString(const char *str)
+{
+  FuzzStream((const uint8_t *)str, (int)strlen(str));
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void FuzzAdversarial(void)
+{
+  static const char *prefixes[] = { "", "s", "s0", "s3", "s01", "s015", "s0150" };
+  uint8_t buf[FUZZ_MAX_STREAM];
+  unsigned p;
+  int ch, i;
+
+  FuzzString("s01500");
+  FuzzString("ss01500");
+  FuzzString("s41500");
+  FuzzString("s0150x");
+  FuzzString("s10000");
+  FuzzString("xs21234s10000");
+  FuzzString("s0s0s0s0s01500");
+  FuzzString("s0150s01500");
+
+  // runs of 's' and of truncated "s0"
+  memset(buf, 's', sizeof(buf));
+  FuzzStream(buf, sizeof(buf));
+  for (i = 0; i + 1 < (int)sizeof(buf); i += 2) { buf[i] = 's'; buf[i + 1] = '0'; }
+  FuzzStream(buf, sizeof(buf));
+
+  // every byte value in every parser state, followed by a valid command
+  for (p = 0; p < sizeof(prefixes) / sizeof(prefixes[0]); p++)
+  {
+    for (ch = 0; ch < 256; ch++)
+    {
+      int len = (int)strlen(prefixes[p]);
+
+      memcpy(buf, prefixes[p], len);
+      buf[len++] = (uint8_t)ch;
+      memcpy(&buf[len], "s29999", 6);
+      FuzzStream(buf, len + 6);
+    }
+  }
+
+  // all 256 values back to back
+  for (ch = 0; ch < 256; ch++) { buf[ch] = (uint8_t)ch; }
+  FuzzStream(buf, 256);
+}
+
+//----------------------------------------------------------------------------
+// Mostly command-shaped bytes so the interesting states are reached often
+//----------------------------------------------------------------------------
+static uint8_t RandomByte(void)
+{
+  uint32_t r = HostRandom();
+
+  switch (r & 7)
+  {
+    case 0:
+    case 1: return 's';
+    case 2:
+    case 3:
+    case 4: return (uint8_t)('0' + ((r >> 8) % 10));
+    default: return (uint8_t)(r >> 8);
+  }
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], 0, 0) : 200000;
+  uint32_t seed = (argc > 2) ? (uint32_t)strtoul(argv[2], 0, 0) : 1;
+  uint8_t buf[FUZZ_MAX_STREAM];
+  uint32_t n;
+  int i;
+
+  HostSeedRandom(seed);
+  FuzzAdversarial();
+
+  for (n = 0; n < iterations; n++)
+  {
+    int size = (int)(HostRandom() % (FUZZ_MAX_STREAM + 1));
+
+    for (i = 0; i < size; i++)
+    {
+      buf[i] = ((n & 3) == 0) ? (uint8_t)HostRandom() : RandomByte();
+    }
+    FuzzStream(buf, size);
+  }
+
+  printf("CommandFuzz: %u streams, %u bytes, %u commands, seed %u: OK\n",
+         numStreams, numBytes, numCommands, seed);
+  return 0;
+}
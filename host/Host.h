@@ -0,0 +1,35 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Host harness helpers shared by the benchmark, fuzz and test drivers.
+//
+
+#ifndef _HOST_H_
+#define _HOST_H_
+
+#include <stdint.h>
+
+#define HOST_CHECK(expr)  do { if (!(expr)) { HostFail(__FILE__, __LINE__, #expr); } } while (0)
+
+extern void (*hostWFIHook)(void);
+
+void HostFail(const char *file, int line, const char *expr);
+uint64_t HostNsec(void);
+uint64_t HostCycles(void);
+uint32_t HostRandom(void);
+void HostSeedRandom(uint32_t seed);
+
+// USART1 driven with the host playing the DMA engine (HostUSART.c)
+void USARTHostInit(void);
+void USARTHostRxInject(const uint8_t *buf, uint32_t size);
+void USARTHostTxSink(uint8_t *buf, uint32_t size);
+uint32_t USARTHostTxSent(void);
+uint32_t USARTHostTxComplete(void);
+void USARTHostTxDrain(void);
+uint32_t USARTHostTxHead(void);
+uint32_t USARTHostTxTail(void);
+uint32_t USARTHostTxBufferCount(void);
+uint32_t USARTHostTxDMAIndex(void);
+uint32_t USARTHostBufferSize(void);
+
+#endif
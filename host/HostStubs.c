@@ -0,0 +1,190 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Host implementations of the peripheral library calls used by the
+//  firmware. Registers are plain memory; DMA transfers are only advanced
+//  by the harness (see HostUSART.c).
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "stm32f10x.h"
+#include "stm32f10x_gpio.h"
+#include "stm32f10x_dma.h"
+#include "stm32f10x_usart.h"
+#include "stm32f10x_tim.h"
+#include "Host.h"
+
+DMA_Channel_TypeDef hostDMA1Channel4;
+DMA_Channel_TypeDef hostDMA1Channel5;
+USART_TypeDef hostUSART1;
+GPIO_TypeDef hostGPIOA, hostGPIOB, hostGPIOC;
+TIM_TypeDef hostTIM4;
+uint32_t SystemCoreClock = 72000000;
+
+void (*hostWFIHook)(void);
+
+static uint32_t randomState = 0x2545F491;
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+void HostFail(const char *file, int line, const char *expr)
+{
+  fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+  exit(1);
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+uint64_t HostNsec(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ull) + (uint64_t)ts.tv_nsec;
+}
+
+//----------------------------------------------------------------------------
+// Returns 0 where no cycle counter is available.
+//----------------------------------------------------------------------------
+uint64_t HostCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+// xorshift32, so runs are repeatable for a given seed
+//----------------------------------------------------------------------------
+uint32_t HostRandom(void)
+{
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+void HostSeedRandom(uint32_t seed)
+{
+  randomState = (seed != 0) ? seed : 0x2545F491;
+}
+
+//----------------------------------------------------------------------------
+// Core
+//----------------------------------------------------------------------------
+void HostWFI(void)
+{
+  if (hostWFIHook)
+  {
+    hostWFIHook();
+  }
+}
+
+void SystemInit(void) { }
+void SystemCoreClockUpdate(void) { }
+uint32_t SysTick_Config(uint32_t ticks) { (void)ticks; return 0; }
+void NVIC_Init(NVIC_InitTypeDef *NVIC_InitStruct) { (void)NVIC_InitStruct; }
+void NVIC_EnableIRQ(IRQn_Type IRQn) { (void)IRQn; }
+void NVIC_DisableIRQ(IRQn_Type IRQn) { (void)IRQn; }
+
+//----------------------------------------------------------------------------
+// RCC / GPIO
+//----------------------------------------------------------------------------
+void RCC_AHBPeriphClockCmd(uint32_t RCC_AHBPeriph, FunctionalState NewState) { (void)RCC_AHBPeriph; (void)NewState; }
+void RCC_APB1PeriphClockCmd(uint32_t RCC_APB1Periph, FunctionalState NewState) { (void)RCC_APB1Periph; (void)NewState; }
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState) { (void)RCC_APB2Periph; (void)NewState; }
+void RCC_MCOConfig(uint8_t RCC_MCO) { (void)RCC_MCO; }
+
+void GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_InitStruct) { (void)GPIOx; (void)GPIO_InitStruct; }
+
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  return (GPIOx->IDR & GPIO_Pin) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+// DMA
+//----------------------------------------------------------------------------
+void DMA_DeInit(DMA_Channel_TypeDef *DMAy_Channelx)
+{
+  memset((void *)DMAy_Channelx, 0, sizeof(*DMAy_Channelx));
+}
+
+void DMA_Init(DMA_Channel_TypeDef *DMAy_Channelx, DMA_InitTypeDef *DMA_InitStruct)
+{
+  DMAy_Channelx->CCR = DMA_InitStruct->DMA_DIR | DMA_InitStruct->DMA_Mode |
+                       DMA_InitStruct->DMA_MemoryInc | DMA_InitStruct->DMA_Priority;
+  DMAy_Channelx->CNDTR = DMA_InitStruct->DMA_BufferSize;
+  DMAy_Channelx->CPAR = DMA_InitStruct->DMA_PeripheralBaseAddr;
+  DMAy_Channelx->CMAR = DMA_InitStruct->DMA_MemoryBaseAddr;
+}
+
+void DMA_Cmd(DMA_Channel_TypeDef *DMAy_Channelx, FunctionalState NewState)
+{
+  if (NewState != DISABLE)
+  {
+    DMAy_Channelx->CCR |= DMA_CCR1_EN;
+  }
+  else
+  {
+    DMAy_Channelx->CCR &= ~(uint32_t)DMA_CCR1_EN;
+  }
+}
+
+void DMA_ITConfig(DMA_Channel_TypeDef *DMAy_Channelx, uint32_t DMA_IT, FunctionalState NewState)
+{
+  if (NewState != DISABLE)
+  {
+    DMAy_Channelx->CCR |= DMA_IT;
+  }
+  else
+  {
+    DMAy_Channelx->CCR &= ~DMA_IT;
+  }
+}
+
+uint16_t DMA_GetCurrDataCounter(DMA_Channel_TypeDef *DMAy_Channelx)
+{
+  return (uint16_t)DMAy_Channelx->CNDTR;
+}
+
+void DMA_ClearITPendingBit(uint32_t DMAy_IT) { (void)DMAy_IT; }
+
+//----------------------------------------------------------------------------
+// USART
+//----------------------------------------------------------------------------
+void USART_Init(USART_TypeDef *USARTx, USART_InitTypeDef *USART_InitStruct) { (void)USARTx; (void)USART_InitStruct; }
+void USART_Cmd(USART_TypeDef *USARTx, FunctionalState NewState) { (void)USARTx; (void)NewState; }
+void USART_DMACmd(USART_TypeDef *USARTx, uint16_t USART_DMAReq, FunctionalState NewState) { (void)USARTx; (void)USART_DMAReq; (void)NewState; }
+
+//----------------------------------------------------------------------------
+// TIM
+//----------------------------------------------------------------------------
+void TIM_TimeBaseInit(TIM_TypeDef *TIMx, TIM_TimeBaseInitTypeDef *TIM_TimeBaseInitStruct) { (void)TIMx; (void)TIM_TimeBaseInitStruct; }
+void TIM_OC1Init(TIM_TypeDef *TIMx, TIM_OCInitTypeDef *TIM_OCInitStruct) { TIMx->CCR[0] = TIM_OCInitStruct->TIM_Pulse; }
+void TIM_OC2Init(TIM_TypeDef *TIMx, TIM_OCInitTypeDef *TIM_OCInitStruct) { TIMx->CCR[1] = TIM_OCInitStruct->TIM_Pulse; }
+void TIM_OC3Init(TIM_TypeDef *TIMx, TIM_OCInitTypeDef *TIM_OCInitStruct) { TIMx->CCR[2] = TIM_OCInitStruct->TIM_Pulse; }
+void TIM_OC4Init(TIM_TypeDef *TIMx, TIM_OCInitTypeDef *TIM_OCInitStruct) { TIMx->CCR[3] = TIM_OCInitStruct->TIM_Pulse; }
+void TIM_OC1PreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreload) { (void)TIMx; (void)TIM_OCPreload; }
+void TIM_OC2PreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreload) { (void)TIMx; (void)TIM_OCPreload; }
+void TIM_OC3PreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreload) { (void)TIMx; (void)TIM_OCPreload; }
+void TIM_OC4PreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreload) { (void)TIMx; (void)TIM_OCPreload; }
+void TIM_ARRPreloadConfig(TIM_TypeDef *TIMx, FunctionalState NewState) { (void)TIMx; (void)NewState; }
+void TIM_Cmd(TIM_TypeDef *TIMx, FunctionalState NewState) { (void)TIMx; (void)NewState; }
+void TIM_SetCompare1(TIM_TypeDef *TIMx, uint16_t Compare1) { TIMx->CCR[0] = Compare1; }
+void TIM_SetCompare2(TIM_TypeDef *TIMx, uint16_t Compare2) { TIMx->CCR[1] = Compare2; }
+void TIM_SetCompare3(TIM_TypeDef *TIMx, uint16_t Compare3) { TIMx->CCR[2] = Compare3; }
+void TIM_SetCompare4(TIM_TypeDef *TIMx, uint16_t Compare4) { TIMx->CCR[3] = Compare4; }
@@ -0,0 +1,174 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Builds the firmware USART driver on the host. The driver is included
+//  directly so the harness can reach its static ring state; the harness then
+//  stands in for the DMA engine on both channels:
+//    RX - bytes are written where the circular channel 5 transfer would put
+//         them and CNDTR counts down, reloading at zero.
+//    TX - an enabled channel 4 transfer is completed in one go and the
+//         transfer complete interrupt handler is run. This happens from
+//         __WFI(), so a writer blocked on a full ring makes progress.
+//
+
+#include <stdio.h>
+#include "../USART.c"
+#include "Host.h"
+
+// Consecutive __WFI() calls that may pass with no TX progress before the
+// driver is declared stalled
+#define HOST_MAX_IDLE_WFI     (1000)
+
+static uint8_t *txSink;
+static uint32_t txSinkSize;
+static uint32_t txSent;
+static uint32_t idleWFICount;
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void USARTHostWFI(void)
+{
+  if (USARTHostTxComplete() != 0)
+  {
+    idleWFICount = 0;
+  }
+  else if (++idleWFICount > HOST_MAX_IDLE_WFI)
+  {
+    HostFail(__FILE__, __LINE__, "USART TX stalled in __WFI()");
+  }
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+void USARTHostInit(void)
+{
+  USARTInit(USART_DEVNUM_1, 115200, 0);
+  txSink = 0;
+  txSinkSize = 0;
+  txSent = 0;
+  idleWFICount = 0;
+  hostWFIHook = USARTHostWFI;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+void USARTHostRxInject(const uint8_t *buf, uint32_t size)
+{
+  USARTDevStruct_t *devPtr = &device[USART_DEVNUM_1];
+
+  while (size--)
+  {
+    devPtr->rxBuffer[USART_BUFFER_SIZE - devPtr->dmaRxChannel->CNDTR] = *(buf++);
+
+    if (--devPtr->dmaRxChannel->CNDTR == 0)
+    {
+      devPtr->dmaRxChannel->CNDTR = USART_BUFFER_SIZE;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Bytes sent beyond the sink size are counted but not captured.
+//----------------------------------------------------------------------------
+void USARTHostTxSink(uint8_t *buf, uint32_t size)
+{
+  txSink = buf;
+  txSinkSize = size;
+  txSent = 0;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+uint32_t USARTHostTxSent(void)
+{
+  return txSent;
+}
+
+//----------------------------------------------------------------------------
+// Finish the in-flight TX transfer, if any, and run the channel 4 interrupt.
+// Returns the number of bytes the transfer sent.
+//----------------------------------------------------------------------------
+uint32_t USARTHostTxComplete(void)
+{
+  USARTDevStruct_t *devPtr = &device[USART_DEVNUM_1];
+  uint32_t idx, count, i;
+
+  if ((devPtr->dmaTxChannel->CCR & DMA_CCR1_EN) == 0)
+  {
+    return 0;
+  }
+
+  idx = USARTHostTxDMAIndex();
+  count = devPtr->dmaTxChannel->CNDTR;
+  HOST_CHECK(idx < USART_BUFFER_SIZE);
+  HOST_CHECK(count <= USART_BUFFER_SIZE - idx);
+
+  for (i = 0; i < count; i++)
+  {
+    if (txSink && (txSent < txSinkSize))
+    {
+      txSink[txSent] = devPtr->txBuffer[idx + i];
+    }
+    txSent++;
+  }
+
+  devPtr->dmaTxChannel->CNDTR = 0;
+  DMA1_Channel4_IRQHandler();
+
+  return count;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+void USARTHostTxDrain(void)
+{
+  while (USARTHostTxComplete() != 0) { };
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+uint32_t USARTHostTxHead(void)
+{
+  return device[USART_DEVNUM_1].txBufferHead;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+uint32_t USARTHostTxTail(void)
+{
+  return device[USART_DEVNUM_1].txBufferTail;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+uint32_t USARTHostTxBufferCount(void)
+{
+  return device[USART_DEVNUM_1].txBufferCount;
+}
+
+//----------------------------------------------------------------------------
+// CMAR only holds the low 32 bits of a host pointer, which is still enough
+// to recover the offset into txBuffer.
+//----------------------------------------------------------------------------
+uint32_t USARTHostTxDMAIndex(void)
+{
+  USARTDevStruct_t *devPtr = &device[USART_DEVNUM_1];
+
+  return devPtr->dmaTxChannel->CMAR - (uint32_t)(uintptr_t)devPtr->txBuffer;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+uint32_t USARTHostBufferSize(void)
+{
+  return USART_BUFFER_SIZE;
+}
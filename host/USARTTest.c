@@ -0,0 +1,211 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Exercises the USART RX and TX ring index arithmetic across the
+//  USART_BUFFER_SIZE wrap, with the host standing in for the DMA engine.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include "USART.h"
+#include "Host.h"
+
+#define TEST_STREAM_SIZE      (256 * 1024)
+
+static uint8_t sent[TEST_STREAM_SIZE];
+static uint8_t received[TEST_STREAM_SIZE];
+static uint32_t numSent;
+static uint32_t numReceived;
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void FillRandom(uint8_t *buf, uint32_t size)
+{
+  while (size--)
+  {
+    *(buf++) = (uint8_t)HostRandom();
+  }
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void RxCheck(uint32_t size)
+{
+  uint32_t i;
+
+  FillRandom(sent, size);
+  USARTHostRxInject(sent, size);
+
+  for (i = 0; i < size; i++)
+  {
+    HOST_CHECK(USARTRxAvailable(USART_DEVNUM_1));
+    HOST_CHECK(USARTReadByte(USART_DEVNUM_1) == sent[i]);
+  }
+
+  HOST_CHECK(!USARTRxAvailable(USART_DEVNUM_1));
+  numReceived += size;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void TestRxWrap(void)
+{
+  uint32_t size = USARTHostBufferSize();
+  int round;
+
+  USARTHostInit();
+  numReceived = 0;
+  HOST_CHECK(!USARTRxAvailable(USART_DEVNUM_1));
+
+  // stop one short of the end, then read straight across the wrap
+  RxCheck(size - 1);
+  RxCheck(2);
+  RxCheck(size - 1);
+  RxCheck(1);
+  RxCheck(1);
+
+  // the ring can hold at most size - 1 unread bytes
+  for (round = 0; round < 2000; round++)
+  {
+    RxCheck(1 + (HostRandom() % (size - 1)));
+  }
+
+  HOST_CHECK(USARTGetStats(USART_DEVNUM_1)->rxNumBytes == numReceived);
+  printf("  RX wrap: %u bytes in order\n", numReceived);
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void TxWrite(uint32_t size)
+{
+  HOST_CHECK(numSent + size <= TEST_STREAM_SIZE);
+  FillRandom(&sent[numSent], size);
+  USARTWriteBuf(USART_DEVNUM_1, &sent[numSent], (uint16_t)size);
+  numSent += size;
+
+  HOST_CHECK(USARTHostTxBufferCount() <= USARTHostBufferSize());
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void TxStart(void)
+{
+  USARTHostInit();
+  USARTHostTxSink(received, sizeof(received));
+  numSent = 0;
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void TxFinish(const char *name)
+{
+  USARTHostTxDrain();
+
+  HOST_CHECK(USARTHostTxSent() == numSent);
+  HOST_CHECK(memcmp(sent, received, numSent) == 0);
+  HOST_CHECK(USARTHostTxHead() == USARTHostTxTail());
+  HOST_CHECK(USARTTxEmpty(USART_DEVNUM_1));
+  HOST_CHECK(USARTGetStats(USART_DEVNUM_1)->txNumBytes == numSent);
+  HOST_CHECK(USARTGetStats(USART_DEVNUM_1)->maxTxFifoCount <= USARTHostBufferSize());
+
+  printf("  %s: %u bytes in order\n", name, numSent);
+}
+
+//----------------------------------------------------------------------------
+// A write that wraps is sent as two DMA transfers
+//----------------------------------------------------------------------------
+static void TestTxWrapSplit(void)
+{
+  uint32_t size = USARTHostBufferSize();
+
+  TxStart();
+  TxWrite(size - 24);
+  USARTHostTxDrain();
+  HOST_CHECK(USARTHostTxHead() == size - 24);
+
+  TxWrite(100);
+  HOST_CHECK(USARTHostTxDMAIndex() == size - 24);
+  HOST_CHECK(DMA1_Channel4->CNDTR == 24);
+  HOST_CHECK(USARTHostTxTail() == 0);
+  HOST_CHECK(USARTHostTxBufferCount() == 100);
+
+  HOST_CHECK(USARTHostTxComplete() == 24);
+  HOST_CHECK(USARTHostTxDMAIndex() == 0);
+  HOST_CHECK(DMA1_Channel4->CNDTR == 76);
+  HOST_CHECK(USARTHostTxTail() == 76);
+  HOST_CHECK(USARTHostTxBufferCount() == 76);
+
+  HOST_CHECK(USARTHostTxComplete() == 76);
+  HOST_CHECK(USARTHostTxBufferCount() == 0);
+  HOST_CHECK((DMA1_Channel4->CCR & DMA_CCR1_EN) == 0);
+
+  TxFinish("TX wrap split");
+}
+
+//----------------------------------------------------------------------------
+// Keep writing while the first half of a wrapped transfer is in flight; the
+// writer has to wait for both halves rather than overrun them.
+//----------------------------------------------------------------------------
+static void TestTxWrapBackpressure(void)
+{
+  uint32_t size = USARTHostBufferSize();
+
+  TxStart();
+  TxWrite(size - 24);
+  USARTHostTxDrain();
+  TxWrite(100);
+  TxWrite(size);
+  TxWrite(size - 1);
+  TxFinish("TX wrap backpressure");
+}
+
+//----------------------------------------------------------------------------
+// One write bigger than the ring, with no transfer running to drain it
+//----------------------------------------------------------------------------
+static void TestTxOversizeWrite(void)
+{
+  TxStart();
+  TxWrite((3 * USARTHostBufferSize()) + 17);
+  TxFinish("TX oversize write");
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+static void TestTxRandom(void)
+{
+  TxStart();
+
+  while (numSent < TEST_STREAM_SIZE - 512)
+  {
+    TxWrite(1 + (HostRandom() % 511));
+
+    if (HostRandom() & 1)
+    {
+      USARTHostTxComplete();
+    }
+  }
+
+  TxFinish("TX random");
+}
+
+//----------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------
+int main(void)
+{
+  TestRxWrap();
+  TestTxWrapSplit();
+  TestTxWrapBackpressure();
+  TestTxOversizeWrite();
+  TestTxRandom();
+
+  printf("USARTTest: OK\n");
+  return 0;
+}
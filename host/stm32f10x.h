@@ -0,0 +1,107 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Host stand-in for the STM32F10x device header. Only the registers, types
+//  and library calls used by the firmware sources are provided; peripherals
+//  are plain structs in host memory so the harness can play the DMA engine.
+//
+
+#ifndef _STM32F10X_H_
+#define _STM32F10X_H_
+
+#include <stdint.h>
+
+#define __IO volatile
+
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+
+typedef enum
+{
+  DMA1_Channel4_IRQn = 14,
+  DMA1_Channel5_IRQn = 15
+} IRQn_Type;
+
+typedef struct
+{
+  __IO uint32_t CCR;
+  __IO uint32_t CNDTR;
+  __IO uint32_t CPAR;
+  __IO uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+  __IO uint16_t SR;
+  __IO uint16_t DR;
+  __IO uint16_t BRR;
+  __IO uint16_t CR1;
+  __IO uint16_t CR2;
+  __IO uint16_t CR3;
+} USART_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CRL;
+  __IO uint32_t CRH;
+  __IO uint32_t IDR;
+  __IO uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  __IO uint16_t CCR[4];
+} TIM_TypeDef;
+
+extern DMA_Channel_TypeDef hostDMA1Channel4;
+extern DMA_Channel_TypeDef hostDMA1Channel5;
+extern USART_TypeDef hostUSART1;
+extern GPIO_TypeDef hostGPIOA, hostGPIOB, hostGPIOC;
+extern TIM_TypeDef hostTIM4;
+
+#define DMA1_Channel4         (&hostDMA1Channel4)
+#define DMA1_Channel5         (&hostDMA1Channel5)
+#define USART1                (&hostUSART1)
+#define GPIOA                 (&hostGPIOA)
+#define GPIOB                 (&hostGPIOB)
+#define GPIOC                 (&hostGPIOC)
+#define TIM4                  (&hostTIM4)
+
+#define DMA_CCR1_EN           ((uint16_t)0x0001)
+
+// Core
+typedef struct
+{
+  uint8_t NVIC_IRQChannel;
+  uint8_t NVIC_IRQChannelPreemptionPriority;
+  uint8_t NVIC_IRQChannelSubPriority;
+  FunctionalState NVIC_IRQChannelCmd;
+} NVIC_InitTypeDef;
+
+extern uint32_t SystemCoreClock;
+
+void HostWFI(void);
+#define __WFI()               HostWFI()
+
+void SystemInit(void);
+void SystemCoreClockUpdate(void);
+uint32_t SysTick_Config(uint32_t ticks);
+void NVIC_Init(NVIC_InitTypeDef *NVIC_InitStruct);
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+
+// RCC
+#define RCC_AHBPeriph_DMA1    ((uint32_t)0x00000001)
+#define RCC_APB2Periph_AFIO   ((uint32_t)0x00000001)
+#define RCC_APB2Periph_GPIOA  ((uint32_t)0x00000004)
+#define RCC_APB2Periph_GPIOB  ((uint32_t)0x00000008)
+#define RCC_APB2Periph_GPIOC  ((uint32_t)0x00000010)
+#define RCC_APB2Periph_USART1 ((uint32_t)0x00004000)
+#define RCC_APB1Periph_TIM4   ((uint32_t)0x00000004)
+#define RCC_MCO_PLLCLK_Div2   ((uint8_t)0x07)
+
+void RCC_AHBPeriphClockCmd(uint32_t RCC_AHBPeriph, FunctionalState NewState);
+void RCC_APB1PeriphClockCmd(uint32_t RCC_APB1Periph, FunctionalState NewState);
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState);
+void RCC_MCOConfig(uint8_t RCC_MCO);
+
+#endif
@@ -0,0 +1,50 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Host stand-in for the STM32F10x DMA library header.
+//
+
+#ifndef _STM32F10X_DMA_H_
+#define _STM32F10X_DMA_H_
+
+#include "stm32f10x.h"
+
+typedef struct
+{
+  uint32_t DMA_PeripheralBaseAddr;
+  uint32_t DMA_MemoryBaseAddr;
+  uint32_t DMA_DIR;
+  uint32_t DMA_BufferSize;
+  uint32_t DMA_PeripheralInc;
+  uint32_t DMA_MemoryInc;
+  uint32_t DMA_PeripheralDataSize;
+  uint32_t DMA_MemoryDataSize;
+  uint32_t DMA_Mode;
+  uint32_t DMA_Priority;
+  uint32_t DMA_M2M;
+} DMA_InitTypeDef;
+
+#define DMA_DIR_PeripheralDST         ((uint32_t)0x00000010)
+#define DMA_DIR_PeripheralSRC         ((uint32_t)0x00000000)
+#define DMA_PeripheralInc_Disable     ((uint32_t)0x00000000)
+#define DMA_MemoryInc_Enable          ((uint32_t)0x00000080)
+#define DMA_PeripheralDataSize_Byte   ((uint32_t)0x00000000)
+#define DMA_MemoryDataSize_Byte       ((uint32_t)0x00000000)
+#define DMA_Mode_Circular             ((uint32_t)0x00000020)
+#define DMA_Mode_Normal               ((uint32_t)0x00000000)
+#define DMA_Priority_Medium           ((uint32_t)0x00001000)
+#define DMA_M2M_Disable               ((uint32_t)0x00000000)
+#define DMA_IT_TC                     ((uint32_t)0x00000002)
+
+#define DMA1_IT_TC4                   ((uint32_t)0x00002000)
+#define DMA1_IT_GL5                   ((uint32_t)0x00010000)
+#define DMA1_IT_TC5                   ((uint32_t)0x00020000)
+
+void DMA_DeInit(DMA_Channel_TypeDef *DMAy_Channelx);
+void DMA_Init(DMA_Channel_TypeDef *DMAy_Channelx, DMA_InitTypeDef *DMA_InitStruct);
+void DMA_Cmd(DMA_Channel_TypeDef *DMAy_Channelx, FunctionalState NewState);
+void DMA_ITConfig(DMA_Channel_TypeDef *DMAy_Channelx, uint32_t DMA_IT, FunctionalState NewState);
+uint16_t DMA_GetCurrDataCounter(DMA_Channel_TypeDef *DMAy_Channelx);
+void DMA_ClearITPendingBit(uint32_t DMAy_IT);
+
+#endif
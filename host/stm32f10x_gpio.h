@@ -0,0 +1,49 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Host stand-in for the STM32F10x GPIO library header.
+//
+
+#ifndef _STM32F10X_GPIO_H_
+#define _STM32F10X_GPIO_H_
+
+#include "stm32f10x.h"
+
+#define GPIO_Pin_0            ((uint16_t)0x0001)
+#define GPIO_Pin_1            ((uint16_t)0x0002)
+#define GPIO_Pin_6            ((uint16_t)0x0040)
+#define GPIO_Pin_7            ((uint16_t)0x0080)
+#define GPIO_Pin_8            ((uint16_t)0x0100)
+#define GPIO_Pin_9            ((uint16_t)0x0200)
+#define GPIO_Pin_10           ((uint16_t)0x0400)
+
+typedef enum
+{
+  GPIO_Speed_10MHz = 1,
+  GPIO_Speed_2MHz,
+  GPIO_Speed_50MHz
+} GPIOSpeed_TypeDef;
+
+typedef enum
+{
+  GPIO_Mode_AIN = 0x0,
+  GPIO_Mode_IN_FLOATING = 0x04,
+  GPIO_Mode_IPD = 0x28,
+  GPIO_Mode_IPU = 0x48,
+  GPIO_Mode_Out_OD = 0x14,
+  GPIO_Mode_Out_PP = 0x10,
+  GPIO_Mode_AF_OD = 0x1C,
+  GPIO_Mode_AF_PP = 0x18
+} GPIOMode_TypeDef;
+
+typedef struct
+{
+  uint16_t GPIO_Pin;
+  GPIOSpeed_TypeDef GPIO_Speed;
+  GPIOMode_TypeDef GPIO_Mode;
+} GPIO_InitTypeDef;
+
+void GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_InitStruct);
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+#endif
@@ -0,0 +1,57 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Host stand-in for the STM32F10x timer library header. Compare values
+//  land in TIM4->CCR[] so tests can check which servo a command moved.
+//
+
+#ifndef _STM32F10X_TIM_H_
+#define _STM32F10X_TIM_H_
+
+#include "stm32f10x.h"
+
+typedef struct
+{
+  uint16_t TIM_Prescaler;
+  uint16_t TIM_CounterMode;
+  uint16_t TIM_Period;
+  uint16_t TIM_ClockDivision;
+  uint8_t TIM_RepetitionCounter;
+} TIM_TimeBaseInitTypeDef;
+
+typedef struct
+{
+  uint16_t TIM_OCMode;
+  uint16_t TIM_OutputState;
+  uint16_t TIM_OutputNState;
+  uint16_t TIM_Pulse;
+  uint16_t TIM_OCPolarity;
+  uint16_t TIM_OCNPolarity;
+  uint16_t TIM_OCIdleState;
+  uint16_t TIM_OCNIdleState;
+} TIM_OCInitTypeDef;
+
+#define TIM_CounterMode_Up        ((uint16_t)0x0000)
+#define TIM_CKD_DIV1              ((uint16_t)0x0000)
+#define TIM_OCMode_PWM1           ((uint16_t)0x0060)
+#define TIM_OutputState_Enable    ((uint16_t)0x0001)
+#define TIM_OCPolarity_High       ((uint16_t)0x0000)
+#define TIM_OCPreload_Enable      ((uint16_t)0x0008)
+
+void TIM_TimeBaseInit(TIM_TypeDef *TIMx, TIM_TimeBaseInitTypeDef *TIM_TimeBaseInitStruct);
+void TIM_OC1Init(TIM_TypeDef *TIMx, TIM_OCInitTypeDef *TIM_OCInitStruct);
+void TIM_OC2Init(TIM_TypeDef *TIMx, TIM_OCInitTypeDef *TIM_OCInitStruct);
+void TIM_OC3Init(TIM_TypeDef *TIMx, TIM_OCInitTypeDef *TIM_OCInitStruct);
+void TIM_OC4Init(TIM_TypeDef *TIMx, TIM_OCInitTypeDef *TIM_OCInitStruct);
+void TIM_OC1PreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreload);
+void TIM_OC2PreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreload);
+void TIM_OC3PreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreload);
+void TIM_OC4PreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreload);
+void TIM_ARRPreloadConfig(TIM_TypeDef *TIMx, FunctionalState NewState);
+void TIM_Cmd(TIM_TypeDef *TIMx, FunctionalState NewState);
+void TIM_SetCompare1(TIM_TypeDef *TIMx, uint16_t Compare1);
+void TIM_SetCompare2(TIM_TypeDef *TIMx, uint16_t Compare2);
+void TIM_SetCompare3(TIM_TypeDef *TIMx, uint16_t Compare3);
+void TIM_SetCompare4(TIM_TypeDef *TIMx, uint16_t Compare4);
+
+#endif
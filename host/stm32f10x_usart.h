@@ -0,0 +1,35 @@
+//
+//  Copyright (c) 2016, Stanford P. Hudson, All Rights Reserved
+//
+//  Host stand-in for the STM32F10x USART library header.
+//
+
+#ifndef _STM32F10X_USART_H_
+#define _STM32F10X_USART_H_
+
+#include "stm32f10x.h"
+
+typedef struct
+{
+  uint32_t USART_BaudRate;
+  uint16_t USART_WordLength;
+  uint16_t USART_StopBits;
+  uint16_t USART_Parity;
+  uint16_t USART_Mode;
+  uint16_t USART_HardwareFlowControl;
+} USART_InitTypeDef;
+
+#define USART_WordLength_8b               ((uint16_t)0x0000)
+#define USART_StopBits_1                  ((uint16_t)0x0000)
+#define USART_Parity_No                   ((uint16_t)0x0000)
+#define USART_Mode_Rx                     ((uint16_t)0x0004)
+#define USART_Mode_Tx                     ((uint16_t)0x0008)
+#define USART_HardwareFlowControl_None    ((uint16_t)0x0000)
+#define USART_DMAReq_Tx                   ((uint16_t)0x0080)
+#define USART_DMAReq_Rx                   ((uint16_t)0x0040)
+
+void USART_Init(USART_TypeDef *USARTx, USART_InitTypeDef *USART_InitStruct);
+void USART_Cmd(USART_TypeDef *USARTx, FunctionalState NewState);
+void USART_DMACmd(USART_TypeDef *USARTx, uint16_t USART_DMAReq, FunctionalState NewState);
+
+#endif